@@ -0,0 +1,9 @@
+/* : : generated from /root/repo/src/lib/libast/features/param.sh by iffe version 2024-08-02 : : */
+#ifndef _def_param_ast
+#define _def_param_ast	1
+#define _sys_types	1	/* #include <sys/types.h> ok */
+#include <sys/param.h>
+#ifndef S_IFDIR
+#include <sys/stat.h>
+#endif
+#endif
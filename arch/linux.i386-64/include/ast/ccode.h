@@ -0,0 +1,80 @@
+/***********************************************************************
+*                                                                      *
+*               This software is part of the ast package               *
+*          Copyright (c) 1985-2011 AT&T Intellectual Property          *
+*          Copyright (c) 2020-2023 Contributors to ksh 93u+m           *
+*                      and is licensed under the                       *
+*                 Eclipse Public License, Version 2.0                  *
+*                                                                      *
+*                A copy of the License is available at                 *
+*      https://www.eclipse.org/org/documents/epl-2.0/EPL-2.0.html      *
+*         (with md5 checksum 84283fa8859daf213bdda5a9f8d1be1d)         *
+*                                                                      *
+*                 Glenn Fowler <gsf@research.att.com>                  *
+*                  David Korn <dgk@research.att.com>                   *
+*                   Phong Vo <kpv@research.att.com>                    *
+*                  Martijn Dekker <martijn@inlv.org>                   *
+*                                                                      *
+***********************************************************************/
+
+/*
+ * Glenn Fowler
+ * AT&T Research
+ *
+ * character code map interface
+ *
+ * NOTE: used for mapping between 8-bit character encodings
+ *	 ISO character sets are handled by sfio
+ */
+
+#ifndef _CHARCODE_H
+#define _CHARCODE_H	1
+
+#include <ast_common.h>
+#include <ast_ccode.h>
+
+typedef struct Ccmap_s
+{
+	const char*	name;	/* code set name		*/
+	const char*	match;	/* strmatch() pattern		*/
+	const char*	desc;	/* code set description		*/
+	const char*	canon;	/* canonical name format	*/
+	const char*	index;	/* default index		*/
+	int		ccode;	/* <ccode.h> code index		*/
+	void*		data;	/* map specific data		*/
+} Ccmap_t;
+
+extern unsigned char*	_ccmap(int, int);
+extern void*		_ccmapcpy(unsigned char*, void*, const void*, size_t);
+extern void*		_ccmapstr(unsigned char*, void*, size_t);
+
+extern int		ccmapid(const char*);
+extern char*		ccmapname(int);
+extern void*		ccnative(void*, const void*, size_t);
+extern Ccmap_t*		ccmaplist(Ccmap_t*);
+
+#define CCOP(i,o)		((i)==(o)?0:(((o)<<8)|(i)))
+#define CCIN(x)			((x)&0xFF)
+#define CCOUT(x)		(((x)>>8)&0xFF)
+#define CCCONVERT(x)		((x)&0xFF00)
+
+#define CCCVT(x)		CCMAP(x,0)
+#define CCMAP(i,o)		((i)==(o)?(unsigned char*)0:_ccmap(i,o))
+#define CCMAPCHR(m,c)		((m)?(m)[c]:(c))
+#define CCMAPCPY(m,t,f,n)	((m)?_ccmapcpy(m,t,f,n):memcpy(t,f,n))
+#define CCMAPSTR(m,s,n)		((m)?_ccmapstr(m,s,n):(void*)(s))
+
+#define ccmap(i,o)		CCMAP(i,o)
+#define ccmapchr(m,c)		CCMAPCHR(m,c)
+#define ccmapcpy(m,t,f,n)	CCMAPCPY(m,t,f,n)
+#define ccmapstr(m,s,n)		CCMAPSTR(m,s,n)
+
+#define CCMAPC(c,i,o)		((i)==(o)?(c):CCMAP(i,o)[c])
+#define CCMAPM(t,f,n,i,o)	((i)==(o)?memcpy(t,f,n):_ccmapcpy(CCMAP(i,o),t,f,n))
+#define CCMAPS(s,n,i,o)		((i)==(o)?(void*)(s):_ccmapstr(CCMAP(i,o),s,n))
+
+#define ccmapc(c,i,o)		CCMAPC(c,i,o)
+#define ccmapm(t,f,n,i,o)	CCMAPM(t,f,n,i,o)
+#define ccmaps(s,n,i,o)		CCMAPS(s,n,i,o)
+
+#endif
@@ -0,0 +1,14 @@
+/* : : generated from /root/repo/src/lib/libast/features/standards by iffe version 2024-08-02 : : */
+#ifndef _def_standards_ast
+#define _def_standards_ast	1
+#define _sys_types	1	/* #include <sys/types.h> ok */
+/* GNU (glibc), Cygwin, or Android */
+#ifndef _GNU_SOURCE
+#define _GNU_SOURCE	1
+#endif
+#ifndef _FILE_OFFSET_BITS
+#define _FILE_OFFSET_BITS 64
+#endif
+#define basename	basename	/* avoid string.h defining this in conflict with AST basename(3) */
+
+#endif
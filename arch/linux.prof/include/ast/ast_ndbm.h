@@ -0,0 +1,5 @@
+/* : : generated from /root/repo/src/lib/libast/features/ndbm by iffe version 2024-08-02 : : */
+#ifndef _def_ndbm_ast
+#define _def_ndbm_ast	1
+#define _sys_types	1	/* #include <sys/types.h> ok */
+#endif
@@ -0,0 +1,3 @@
+/* generated by libast/Mamfile using git version 2.39.5 */
+/* not on a git release branch; _AST_release not defined by default */
+#define _AST_git_commit   "af4fe2c1"
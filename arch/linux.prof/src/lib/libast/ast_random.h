@@ -0,0 +1,14 @@
+/* : : generated from /root/repo/src/lib/libast/features/random by iffe version 2024-08-02 : : */
+#ifndef _def_random_ast
+#define _def_random_ast	1
+#define _sys_types	1	/* #include <sys/types.h> ok */
+#define _sys_random	1	/* #include <sys/random.h> ok */
+#define _lib_arc4random	1	/* arc4random() in default lib(s) */
+#define _lib_arc4random_buf	1	/* arc4random_buf() in default lib(s) */
+#define _lib_arc4random_uniform	1	/* arc4random_uniform() in default lib(s) */
+#define _lib_getentropy	1	/* getentropy() in default lib(s) */
+#define _lib_getrandom	1	/* getrandom() in default lib(s) */
+#define _lib_explicit_bzero	1	/* explicit_bzero() in default lib(s) */
+#define _pth_urandom	"/dev/urandom"	/* urandom path */
+#define _pth_random	"/dev/random"	/* random path */
+#endif
@@ -120,6 +120,8 @@ const Shtable_t shtab_stats[] =
 	"linesread",		STAT_READS,
 	"nv_cachehit",		STAT_NVHITS,
 	"nv_opens",		STAT_NVOPEN,
+	"parsecache_hits",	STAT_PCHITS,
+	"parsecache_misses",	STAT_PCMISSES,
 	"pathsearch",		STAT_PATHS,
 	"posixfuncall",		STAT_SVFUNCT,
 	"simplecmds",		STAT_SCMDS,
@@ -228,11 +228,13 @@ extern const char	e_scriptonly[];
 #   define	STAT_READS	6
 #   define	STAT_NVHITS	7
 #   define	STAT_NVOPEN	8
-#   define	STAT_PATHS	9
-#   define	STAT_SVFUNCT	10
-#   define	STAT_SCMDS	11
-#   define	STAT_SPAWN	12
-#   define	STAT_SUBSHELL	13
+#   define	STAT_PCHITS	9
+#   define	STAT_PCMISSES	10
+#   define	STAT_PATHS	11
+#   define	STAT_SVFUNCT	12
+#   define	STAT_SCMDS	13
+#   define	STAT_SPAWN	14
+#   define	STAT_SUBSHELL	15
     extern const Shtable_t shtab_stats[];
 #   define sh_stats(x)	(sh.stats[(x)]++)
 #else
@@ -41,7 +41,9 @@
 struct process
 {
 	struct process *p_nxtjob;	/* next job structure */
+	struct process *p_prvjob;	/* previous job structure */
 	struct process *p_nxtproc;	/* next process in current job */
+	struct process *p_nxtpid;	/* next process in PID hash chain */
 	int		*p_exitval;	/* place to store the exitval */
 	pid_t		p_pid;		/* process ID */
 	pid_t		p_pgrp;		/* process group */
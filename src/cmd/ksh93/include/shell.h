@@ -335,6 +335,7 @@ struct Shell_s
 	char		redir0;		/* redirect of 0 */
 	char		intrace;	/* set when trace expands PS4 */
 	char		*readscript;	/* set before reading a script */
+	void		*pcache;	/* parse cache file to be written by the next sh_eval() */
 	int		*inpipe;	/* input pipe pointer */
 	int		*outpipe;	/* output pipe pointer */
 	int		cpipe[3];
@@ -209,6 +209,9 @@ union Shnode_u
 
 extern void			sh_freeup(void);
 extern void			sh_funstaks(struct slnod*,int);
+extern void			sh_pcclose(void*);
+extern Sfio_t			*sh_pcopen(Sfio_t*, const char*);
+extern void			sh_pcwrite(void*, const Shnode_t*, int);
 extern Sfio_t 			*sh_subshell(Shnode_t*, volatile int, int);
 extern int			sh_tdump(Sfio_t*, const Shnode_t*);
 extern Shnode_t			*sh_trestore(Sfio_t*);
@@ -76,7 +76,10 @@
 struct jobsave
 {
 	struct jobsave	*next;
+	struct jobsave	*prev;
+	struct jobsave	*nxtpid;	/* next in PID hash chain */
 	pid_t		pid;
+	int		level;		/* level of the back_save list it is on */
 	unsigned short	exitval;
 };
 
@@ -117,10 +120,26 @@ static void init_savelist(void)
 struct back_save
 {
 	int		count;
+	int		level;		/* subshell level; 0 for the main shell */
 	struct jobsave	*list;
+	struct jobsave	*last;
 	struct back_save *prev;
 };
 
+/*
+ * Hash tables indexing the processes and the saved exit statuses by PID,
+ * and the jobs by job number, so that looking them up does not take time
+ * proportional to the number of jobs
+ */
+#define PIDHASH(pid,mask)	((unsigned int)(pid)&(mask))
+static struct process	**pidtab;	/* processes by PID; pidmask+1 chains */
+static unsigned int	pidmask;
+static struct jobsave	**savetab;	/* saved exit statuses by PID; savemask+1 chains */
+static unsigned int	savemask;
+static int		nsave;		/* number of saved exit statuses on all levels */
+static struct process	**jobtab;	/* first process of each job by job number */
+static int		njobtab;
+
 #define BYTE(n)		(((n)+CHAR_BIT-1)/CHAR_BIT)
 #define MAXMSG	25
 #define SH_STOPSIG	(SH_EXITSIG<<1)
@@ -162,6 +181,7 @@ static int		job_alloc(void);
 static void		job_free(int);
 static struct process	*job_unpost(struct process*,int);
 static void		job_unlink(struct process*);
+static void		job_link(struct process*);
 static void		job_prmsg(struct process*);
 static struct process	*freelist;
 static char		beenhere;
@@ -225,11 +245,11 @@ void job_chldtrap(int unpost)
  */
 static struct jobsave *jobsave_create(pid_t pid)
 {
-	struct jobsave *jp = job_savelist;
+	struct jobsave *jp;
 	job_chksave(pid);
 	if(++bck.count > sh.lim.child_max)
 		job_chksave(0);
-	if(jp)
+	if(jp = job_savelist)
 	{
 		njob_savelist--;
 		job_savelist = jp->next;
@@ -238,10 +258,38 @@ static struct jobsave *jobsave_create(pid_t pid)
 		jp = sh_newof(0,struct jobsave,1,0);
 	if(jp)
 	{
+		struct jobsave **jpp;
 		jp->pid = pid;
-		jp->next = bck.list;
+		jp->level = bck.level;
+		jp->prev = 0;
+		if(jp->next = bck.list)
+			bck.list->prev = jp;
+		else
+			bck.last = jp;
 		bck.list = jp;
 		jp->exitval = 0;
+		if(++nsave > savemask)
+		{
+			/* grow the hash table */
+			struct jobsave **otab = savetab, *jq;
+			unsigned int i, omask = savemask;
+			savemask = savetab ? 2*savemask+1 : 63;
+			savetab = sh_newof(0,struct jobsave*,savemask+1,0);
+			for(i=0; otab && i<=omask; i++)
+			{
+				while(jq = otab[i])
+				{
+					otab[i] = jq->nxtpid;
+					jpp = &savetab[PIDHASH(jq->pid,savemask)];
+					jq->nxtpid = *jpp;
+					*jpp = jq;
+				}
+			}
+			free(otab);
+		}
+		jpp = &savetab[PIDHASH(pid,savemask)];
+		jp->nxtpid = *jpp;
+		*jpp = jp;
 	}
 	return jp;
 }
@@ -348,8 +396,7 @@ int job_reap(int sig)
 			{
 				/* move to top of job list */
 				job_unlink(px);
-				px->p_nxtjob = job.pwlist;
-				job.pwlist = px;
+				job_link(px);
 			}
 			continue;
 		}
@@ -1054,10 +1101,20 @@ void	job_clear(void)
 	}
 	for(jp=bck.list; jp;jp=jpnext)
 	{
+		struct jobsave **jpp = &savetab[PIDHASH(jp->pid,savemask)];
+		while(*jpp != jp)
+			jpp = &(*jpp)->nxtpid;
+		*jpp = jp->nxtpid;
+		nsave--;
 		jpnext = jp->next;
 		free(jp);
 	}
-	bck.list = 0;
+	bck.list = bck.last = 0;
+	bck.count = 0;
+	if(pidtab)
+		memset(pidtab,0,(pidmask+1)*sizeof(struct process*));
+	if(jobtab)
+		memset(jobtab,0,njobtab*sizeof(struct process*));
 	if(njob_savelist < NJOB_SAVELIST)
 		init_savelist();
 	job.pwlist = NULL;
@@ -1115,8 +1172,7 @@ int job_post(pid_t pid, pid_t join)
 		if(val && (pw=job_byjid(val)) != job.pwlist)
 		{
 			job_unlink(pw);
-			pw->p_nxtjob = job.pwlist;
-			job.pwlist = pw;
+			job_link(pw);
 		}
 	}
 	if(pw=freelist)
@@ -1128,22 +1184,56 @@ int job_post(pid_t pid, pid_t join)
 	if(join && job.pwlist)
 	{
 		/* join existing current job */
-		pw->p_nxtjob = job.pwlist->p_nxtjob;
+		if(pw->p_nxtjob = job.pwlist->p_nxtjob)
+			pw->p_nxtjob->p_prvjob = pw;
+		pw->p_prvjob = 0;
 		pw->p_nxtproc = job.pwlist;
 		pw->p_job = job.pwlist->p_job;
+		job.pwlist = pw;
 	}
 	else
 	{
 		/* create a new job */
 		while((pw->p_job = job_alloc()) < 0)
 			job_wait((pid_t)1);
-		pw->p_nxtjob = job.pwlist;
+		job_link(pw);
 		pw->p_nxtproc = 0;
 	}
 	pw->p_exitval = job.exitval; 
-	job.pwlist = pw;
 	pw->p_env = sh.curenv;
 	pw->p_pid = pid;
+	/* index the process by PID and the job by job number */
+	if(job.numpost > pidmask)
+	{
+		/* grow the hash table, keeping the order of each chain */
+		struct process **otab = pidtab, **pp, *px;
+		unsigned int i, omask = pidmask;
+		pidmask = pidtab ? 2*pidmask+1 : 63;
+		pidtab = sh_newof(0,struct process*,pidmask+1,0);
+		for(i=0; otab && i<=omask; i++)
+		{
+			while(px = otab[i])
+			{
+				otab[i] = px->p_nxtpid;
+				for(pp = &pidtab[PIDHASH(px->p_pid,pidmask)]; *pp; pp = &(*pp)->p_nxtpid);
+				px->p_nxtpid = 0;
+				*pp = px;
+			}
+		}
+		free(otab);
+	}
+	pw->p_nxtpid = pidtab[PIDHASH(pid,pidmask)];
+	pidtab[PIDHASH(pid,pidmask)] = pw;
+	if(pw->p_job >= njobtab)
+	{
+		int n = njobtab ? njobtab : 32;
+		while(n <= pw->p_job)
+			n *= 2;
+		jobtab = sh_newof(jobtab,struct process*,n,0);
+		memset(&jobtab[njobtab],0,(n-njobtab)*sizeof(struct process*));
+		njobtab = n;
+	}
+	jobtab[pw->p_job] = pw;
 	if(!sh.outpipe || sh.cpid==pid)
 		pw->p_flag = P_EXITSAVE;
 	pw->p_exitmin = sh.xargexit;
@@ -1201,13 +1291,14 @@ int job_post(pid_t pid, pid_t join)
  */
 static struct process *job_bypid(pid_t pid)
 {
-	struct process  *pw, *px;
-	for(pw=job.pwlist; pw; pw=pw->p_nxtjob)
-		for(px=pw; px; px=px->p_nxtproc)
-		{
-			if(px->p_pid==pid)
-				return px;
-		}
+	struct process  *px;
+	if(!pidtab)
+		return NULL;
+	for(px=pidtab[PIDHASH(pid,pidmask)]; px; px=px->p_nxtpid)
+	{
+		if(px->p_pid==pid)
+			return px;
+	}
 	return NULL;
 }
 
@@ -1216,13 +1307,9 @@ static struct process *job_bypid(pid_t pid)
  */
 static struct process *job_byjid(int jobid)
 {
-	struct process *pw;
-	for(pw=job.pwlist;pw; pw = pw->p_nxtjob)
-	{
-		if(pw->p_job==jobid)
-			break;
-	}
-	return pw;
+	if(jobid<=0 || jobid>=njobtab)
+		return NULL;
+	return jobtab[jobid];
 }
 
 /*
@@ -1477,8 +1564,7 @@ int job_switch(struct process *pw,int bgflag)
 	else
 	{
 		job_unlink(pw);
-		pw->p_nxtjob = job.pwlist;
-		job.pwlist = pw;
+		job_link(pw);
 		msg = "";
 	}
 	hist_list(sh.hist_ptr,outfile,pw->p_name,'&',";");
@@ -1588,6 +1674,13 @@ static struct process *job_unpost(struct process *pwtop,int notify)
 		}
 		pw->p_flag &= ~P_DONE;
 		job.numpost--;
+		/* remove from the PID hash table */
+		{
+			struct process **pp = &pidtab[PIDHASH(pw->p_pid,pidmask)];
+			while(*pp != pw)
+				pp = &(*pp)->p_nxtpid;
+			*pp = pw->p_nxtpid;
+		}
 		pw->p_nxtjob = freelist;
 		freelist = pw;
 	}
@@ -1605,19 +1698,26 @@ static struct process *job_unpost(struct process *pwtop,int notify)
  */
 static void job_unlink(struct process *pw)
 {
-	struct process *px;
+	if(pw->p_nxtjob)
+		pw->p_nxtjob->p_prvjob = pw->p_prvjob;
 	if(pw==job.pwlist)
 	{
 		job.pwlist = pw->p_nxtjob;
 		job.curpgid = 0;
-		return;
 	}
-	for(px=job.pwlist;px;px=px->p_nxtjob)
-		if(px->p_nxtjob == pw)
-		{
-			px->p_nxtjob = pw->p_nxtjob;
-			return;
-		}
+	else if(pw->p_prvjob)
+		pw->p_prvjob->p_nxtjob = pw->p_nxtjob;
+}
+
+/*
+ * link a job to the front of the job list
+ */
+static void job_link(struct process *pw)
+{
+	pw->p_prvjob = 0;
+	if(pw->p_nxtjob = job.pwlist)
+		job.pwlist->p_prvjob = pw;
+	job.pwlist = pw;
 }
 
 /*
@@ -1656,8 +1756,11 @@ static int job_alloc(void)
  */
 static void job_free(int n)
 {
-	int j = (--n)/CHAR_BIT;
+	int j;
 	unsigned mask;
+	if(n < njobtab)
+		jobtab[n] = 0;
+	j = (--n)/CHAR_BIT;
 	n -= j*CHAR_BIT;
 	mask = 1 << n;
 	job.freejobs[j]  &= ~mask;
@@ -1690,37 +1793,37 @@ static char *job_sigmsg(int sig)
  */
 static int job_chksave(pid_t pid)
 {
-	struct jobsave *jp = bck.list, *jpold=0;
+	struct jobsave *jp, **jpp;
 	int r= -1;
-	int count=bck.count;
 	struct back_save *bp= &bck;
-again:
-	while(jp && count-->0)
+	if(pid)
 	{
-		if(jp->pid==pid)
-			break;
-		if(pid==0 && !jp->next)
-			break;
-		jpold = jp;
-		jp = jp->next;
-	}
-	if(!jp && pid && (bp=bp->prev))
-	{
-		count = bp->count;
-		jp = bp->list;
-		jpold = 0;
-		goto again;
+		/* a PID is saved at most once, on the current level or an outer one */
+		for(jp = savetab ? savetab[PIDHASH(pid,savemask)] : NULL; jp && jp->pid!=pid; jp=jp->nxtpid);
+		while(jp && bp && bp->level!=jp->level)
+			bp = bp->prev;
+		if(!bp)
+			jp = NULL;
 	}
+	else
+		jp = bck.last;
 	if(jp)
 	{
 		r = 0;
 		if(pid)
 			r = jp->exitval;
-		if(jpold)
-			jpold->next = jp->next;
+		if(jp->prev)
+			jp->prev->next = jp->next;
 		else
 			bp->list = jp->next;
+		if(jp->next)
+			jp->next->prev = jp->prev;
+		else
+			bp->last = jp->prev;
 		bp->count--;
+		for(jpp = &savetab[PIDHASH(jp->pid,savemask)]; *jpp!=jp; jpp = &(*jpp)->nxtpid);
+		*jpp = jp->nxtpid;
+		nsave--;
 		if(njob_savelist < NJOB_SAVELIST)
 		{
 			njob_savelist++;
@@ -1738,10 +1841,10 @@ void *job_subsave(void)
 	struct back_save *bp = new_of(struct back_save,0);
 	job_lock();
 	*bp = bck;
-	bp->prev = bck.prev;
 	bck.count = 0;
-	bck.list = 0;
+	bck.list = bck.last = 0;
 	bck.prev = bp;
+	bck.level++;
 	job_unlock();
 	return bp;
 }
@@ -1751,19 +1854,21 @@ void job_subrestore(void* ptr)
 	struct jobsave *jp;
 	struct back_save *bp = (struct back_save*)ptr;
 	struct process *pw, *px, *pwnext;
-	struct jobsave *end=NULL;
 	job_lock();
 	for(jp=bck.list; jp; jp=jp->next)
+		jp->level = bp->level;
+	if(bck.last)
 	{
-		if (!jp->next)
-			end = jp;
+		if(bck.last->next = bp->list)
+			bp->list->prev = bck.last;
 	}
-	if(end)
-		end->next = bp->list;
 	else
 		bck.list = bp->list;
+	if(bp->last)
+		bck.last = bp->last;
 	bck.count += bp->count;
 	bck.prev = bp->prev;
+	bck.level = bp->level;
 	while(bck.count > sh.lim.child_max)
 		job_chksave(0);
 	for(pw=job.pwlist; pw; pw=pwnext)
@@ -31,6 +31,7 @@
 #include	"path.h"
 #include	"io.h"
 #include	"jobs.h"
+#include	"shnodes.h"
 #include	"history.h"
 #include	"test.h"
 #include	"FEATURE/dynamic"
@@ -576,7 +577,7 @@ static void funload(int fno, const char *name)
 	sh.funload = 1;
 	sh.inlineno = 1;
 	error_info.line = 0;
-	sh_eval(sfnew(NULL,buff,IOBSIZE,fno,SFIO_READ),SH_FUNEVAL);
+	sh_eval(sh_pcopen(sfnew(NULL,buff,IOBSIZE,fno,SFIO_READ),pname),SH_FUNEVAL);
 	sh_close(fno);
 	sh.readscript = 0;
 #if SHOPT_NAMESPACE
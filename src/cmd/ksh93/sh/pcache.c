@@ -0,0 +1,229 @@
+/***********************************************************************
+*                                                                      *
+*              This file is part of the ksh 93u+m package              *
+*             Copyright (c) 2026 Contributors to ksh 93u+m             *
+*                      and is licensed under the                       *
+*                 Eclipse Public License, Version 2.0                  *
+*                                                                      *
+*                A copy of the License is available at                 *
+*      https://www.eclipse.org/org/documents/epl-2.0/EPL-2.0.html      *
+*         (with md5 checksum 84283fa8859daf213bdda5a9f8d1be1d)         *
+*                                                                      *
+***********************************************************************/
+/*
+ * Persistent parse cache for autoloaded functions and dot scripts
+ *
+ * If the KSH_PARSECACHE variable names a directory, the parse trees of
+ * FPATH function files and dot scripts are saved there in the binary
+ * format used by shcomp(1) (see tdump.c). The next time the same file is
+ * loaded, the trees are read back by sh_parse() using sh_trestore()
+ * instead of lexing and parsing the file again.
+ *
+ * A cache file is named after a checksum of its key. The key is stored
+ * in full on the first line of the cache file and verified on reading.
+ * It consists of the shell version, the file's pathname, device, inode,
+ * size, modification and change times, and the shell state that affects
+ * how a file is parsed (parser-relevant options and the alias table).
+ */
+
+#include	"shopt.h"
+#include	"defs.h"
+#include	"shnodes.h"
+#include	"path.h"
+#include	"io.h"
+#include	"version.h"
+#include	<tmx.h>
+
+#define CNTL(x)	((x)&037)
+static const char header[6] = { CNTL('k'),CNTL('s'),CNTL('h'),0,SHCOMP_HDR_VERSION,0 };
+
+struct Pcache
+{
+	Sfio_t	*out;		/* stream for the cache file being written */
+	char	*tmpname;	/* temporary name of that file */
+	char	name[1];	/* final name of that file; must be last */
+};
+
+/*
+ * move <fd> out of the range that is available for user redirections
+ */
+static int pc_movefd(int fd)
+{
+	int	n;
+	if(fd >= 0 && fd < 10)
+	{
+		n = fcntl(fd,F_DUPFD,10);
+		close(fd);
+		fd = n;
+	}
+	if(fd >= 0)
+		fcntl(fd,F_SETFD,FD_CLOEXEC);
+	return fd;
+}
+
+/*
+ * check that <fd> is open on a valid cache file for <key>
+ * if so, leave its offset at the start of the shcomp(1) header
+ */
+static int pc_check(int fd, const char *key)
+{
+	struct stat	statb;
+	size_t		n = strlen(key);
+	char		*buf;
+	int		r = 0;
+	/* only trust a regular file that nobody but the current user can have written */
+	if(fstat(fd,&statb) < 0 || !S_ISREG(statb.st_mode) || statb.st_uid!=sh.euserid || (statb.st_mode&(S_IWGRP|S_IWOTH)))
+		return 0;
+	buf = sh_malloc(n+1+sizeof(header));
+	if(read(fd,buf,n+1+sizeof(header))==n+1+sizeof(header)
+	&& memcmp(buf,key,n)==0 && buf[n]=='\n' && memcmp(buf+n+1,header,4)==0
+	&& lseek(fd,(off_t)(n+1),SEEK_SET)==(off_t)(n+1))
+		r = 1;
+	free(buf);
+	return r;
+}
+
+/*
+ * generate the cache key for the file open on <iop> with full pathname <path>
+ * returns the length of the key in sh.strbuf, or 0 if the file cannot be cached
+ */
+static int pc_key(Sfio_t *iop, const char *path)
+{
+	struct stat	statb;
+	Namval_t	*np;
+	unsigned long	asum = 0;
+	int		obits = 0;
+	if(fstat(sffileno(iop),&statb) < 0 || !S_ISREG(statb.st_mode))
+		return 0;
+	/* the shell state that can change the result of parsing the file */
+	if(sh_isoption(SH_POSIX))
+		obits |= 01;
+	if(sh_isoption(SH_BRACEEXPAND))
+		obits |= 02;
+	if(sh_isoption(SH_KEYWORD))
+		obits |= 04;
+	if(sh_isstate(SH_NOALIAS))
+		obits |= 010;
+	if(mbwide())
+		obits |= 020;
+	for(np = (Namval_t*)dtfirst(sh.alias_tree); np; np = (Namval_t*)dtnext(sh.alias_tree,np))
+	{
+		if(!np->nvalue.cp)
+			continue;
+		asum = strsum(np->nvname,asum);
+		asum = strsum(np->nvalue.cp,asum+1);
+	}
+	sfprintf(sh.strbuf,"%s\t%s\t%llu\t%llu\t%lld\t%llu\t%llu\t%o\t%lx",
+		SH_RELEASE, path,
+		(Sfulong_t)statb.st_dev, (Sfulong_t)statb.st_ino, (Sflong_t)statb.st_size,
+		(Sfulong_t)tmxgetmtime(&statb), (Sfulong_t)tmxgetctime(&statb),
+		obits, asum);
+	return sfstrtell(sh.strbuf);
+}
+
+/*
+ * Prepare to evaluate the script open on <iop> with full pathname <path>.
+ * If a valid cache file exists, switch <iop> to reading from it instead.
+ * Otherwise, arrange for the next sh_eval() to save the parse trees.
+ * Returns <iop>.
+ */
+Sfio_t *sh_pcopen(Sfio_t *iop, const char *path)
+{
+	Namval_t	*np;
+	char		*dir, *key;
+	struct Pcache	*pc;
+	size_t		n;
+	int		fd;
+	if(sh_isoption(SH_RESTRICTED))
+		return iop;
+	if(!(np = nv_open("KSH_PARSECACHE",sh.var_tree,NV_NOADD)) || !(dir = nv_getval(np)) || *dir!='/')
+		return iop;
+	if(!pc_key(iop,path))
+		return iop;
+	key = sh_strdup(sfstruse(sh.strbuf));
+	n = strlen(dir)+2*sizeof(unsigned long)+6;
+	pc = sh_malloc(sizeof(struct Pcache)+n);
+	sfsprintf(pc->name,n,"%s/%0*lx.ksc",dir,2*(int)sizeof(unsigned long),strsum(key,0L));
+	if((fd = open(pc->name,O_RDONLY|O_NONBLOCK)) >= 0)
+	{
+		if(pc_check(fd,key))
+		{
+			/* cache hit: substitute the cache file for the script under the same file descriptor */
+			int fno = sffileno(iop);
+			sfsetfd(iop,-1);
+			close(fno);
+			if(fcntl(fd,F_DUPFD,fno)==fno)
+			{
+				close(fd);
+				fcntl(fno,F_SETFD,FD_CLOEXEC);
+				sfsetfd(iop,fno);
+				free(key);
+				free(pc);
+				sh_stats(STAT_PCHITS);
+				return iop;
+			}
+			/* should not happen: the file descriptor was just freed */
+			abort();
+		}
+		close(fd);
+	}
+	/* cache miss: create a temporary file to be renamed to the cache file once parsing is complete */
+	sh_stats(STAT_PCMISSES);
+	n = strlen(pc->name)+3*sizeof(pid_t)+2;
+	pc->tmpname = sh_malloc(n);
+	sfsprintf(pc->tmpname,n,"%s.%d",pc->name,(int)sh.current_pid);
+	if((fd = pc_movefd(open(pc->tmpname,O_WRONLY|O_CREAT|O_EXCL,S_IRUSR|S_IWUSR))) < 0
+	|| !(pc->out = sfnew(NULL,NULL,SFIO_UNBOUND,fd,SFIO_WRITE)))
+	{
+		if(fd >= 0)
+		{
+			close(fd);
+			unlink(pc->tmpname);
+		}
+		free(pc->tmpname);
+		free(pc);
+		free(key);
+		return iop;
+	}
+	sfputr(pc->out,key,'\n');
+	sfwrite(pc->out,header,sizeof(header));
+	free(key);
+	sh.pcache = pc;
+	return iop;
+}
+
+/*
+ * Save parse tree <t> to the cache file being written.
+ * If <done> is set, the file is completely parsed, so install the cache file.
+ */
+void sh_pcwrite(void *ptr, const Shnode_t *t, int done)
+{
+	struct Pcache *pc = (struct Pcache*)ptr;
+	if(!pc->out)
+		return;
+	if(sh_tdump(pc->out,t) < 0)
+		done = -1;
+	if(done)
+	{
+		if(sfclose(pc->out) < 0 || done < 0 || rename(pc->tmpname,pc->name) < 0)
+			unlink(pc->tmpname);
+		pc->out = 0;
+	}
+	else
+		sfsync(pc->out);  /* don't leave buffered data for a forked child process to flush on exit */
+}
+
+/*
+ * Discard the cache file being written if it was not installed, and free <ptr>.
+ */
+void sh_pcclose(void *ptr)
+{
+	struct Pcache *pc = (struct Pcache*)ptr;
+	if(pc->out)
+	{
+		sfclose(pc->out);
+		unlink(pc->tmpname);
+	}
+	free(pc->tmpname);
+	free(pc);
+}
@@ -613,9 +613,11 @@ int sh_eval(Sfio_t *iop, int mode)
 	volatile int traceon=0, lineno=0;
 	int binscript=sh.binscript;
 	char comsub = sh.comsub;
+	void *pcache = sh.pcache;  /* set by sh_pcopen() to save the parse trees */
 	io_save = iop; /* preserve correct value across longjmp */
 	sh.binscript = 0;
 	sh.comsub = 0;
+	sh.pcache = 0;
 	sh_pushcontext(buffp,SH_JMPEVAL);
 	buffp->olist = pp->olist;
 	jmpval = sigsetjmp(buffp->buff,0);
@@ -643,6 +645,8 @@ int sh_eval(Sfio_t *iop, int mode)
 			mode &= ~SH_FUNEVAL;
 		}
 		mode &= ~SH_READEVAL;
+		if(pcache)
+			sh_pcwrite(pcache,t,!(mode&SH_FUNEVAL));
 		if(!sh_isoption(SH_VERBOSE))
 			sh_offstate(SH_VERBOSE);
 		if((mode&~SH_FUNEVAL) && sh.hist_ptr)
@@ -655,6 +659,8 @@ int sh_eval(Sfio_t *iop, int mode)
 			break;
 	}
 	sh_popcontext(buffp);
+	if(pcache)
+		sh_pcclose(pcache);
 	sh.binscript = binscript;
 	sh.comsub = comsub;
 	if(traceon)
@@ -910,6 +916,26 @@ int sh_exec(const Shnode_t *t, int flags)
 			return sh.exitval;
 		}
 	}
+	/* Optimize an arithmetic command '((...))' that was compiled at parse time if the conditions are right */
+	else if(type==TARITH && t->ar.arcomp && !sh.st.trap[SH_DEBUGTRAP] && !sh_isoption(SH_XTRACE))
+	{
+		char *sav = stkfreeze(sh.stk,0);
+		error_info.line = t->ar.arline-sh.st.firstline;
+		sh.exitval = !arith_exec((Arith_t*)t->ar.arcomp);
+		exitset();
+		if(sh.trapnote)
+			sh_chktrap();
+		if(!(flags & ARG_OPTIMIZE))
+		{
+			if(sav != stkptr(sh.stk,0))
+				stkset(sh.stk,sav,0);
+			else if(stktell(sh.stk))
+				stkseek(sh.stk,0);
+		}
+		if(sh.trapnote&SH_SIGSET)
+			sh_exit(SH_EXITSIG|sh.lastsig);
+		return sh.exitval;
+	}
 	/* Normal command execution */
 	{
 		char		*com0 = 0;
@@ -1137,5 +1137,24 @@ else	typeset -ui i
 	unset i
 fi
 
+# ======
+# Arithmetic commands compiled at parse time are run through a fast path in sh_exec().
+# Make sure that it still reports the correct line number and honours xtrace and the DEBUG trap.
+got=$(set +x; eval $'f()\n{\n\t: one\n\t((x = 1 / 0))\n}\nf' 2>&1)
+[[ $got == *': line 4: x = 1 / 0: divide by zero' ]] || err_exit "wrong line number in arithmetic command error" \
+	"(got $(printf %q "$got"))"
+got=$(set +x; PS4='+ '; set -x; ((x = 1 + 2)) 2>&1; set +x; echo $x)
+exp=$'+ ((x = 1 + 2))\n3'
+[[ $got == "$exp" ]] || err_exit "xtrace of arithmetic command" \
+	"(expected $(printf %q "$exp"), got $(printf %q "$got"))"
+got=$(set +x; trap 'echo "[${.sh.command}]"' DEBUG; ((y = 6 * 7)); trap - DEBUG; echo $y)
+exp=$'[(( y = 6 * 7 ))]\n[trap - DEBUG]\n42'
+[[ $got == "$exp" ]] || err_exit "DEBUG trap for arithmetic command" \
+	"(expected $(printf %q "$exp"), got $(printf %q "$got"))"
+integer i n=0
+for ((i = 0; i < 10; i++)); do ((n += i)); done
+((n == 45)) || err_exit "arithmetic 'for' loop (expected 45, got $n)"
+unset i n
+
 # ======
 exit $((Errors<125?Errors:125))
@@ -1577,5 +1577,48 @@ do	got=$(unset -f "$b"; PATH=/dev/null; "$b" --version 2>&1)
 		"(expected status 2 and ERE match of $(printf %q "$exp"), got status $e and $(printf %q "$got"))"
 done
 
+# ======
+# Persistent parse cache for FPATH function files and dot scripts
+mkdir "$tmp/pcache" "$tmp/pcfun" && cd "$tmp" || exit
+cat >pcfun/pcfun <<\EOF
+function pcfun
+{
+	typeset v
+	for v in "$@"
+	do	print -r -- "[${v//o/0}]"
+	done
+}
+EOF
+cat >pcdot.sh <<\EOF
+alias pcal='print -r alias'
+function pcdot { print -r "dot $*"; }
+pcdot ${ print one; } two
+EOF
+script='FPATH=$PWD/pcfun; . ./pcdot.sh; pcfun foo boo; print ${.sh.stats.parsecache_hits} ${.sh.stats.parsecache_misses}'
+exp=$'dot one two\n[f00]\n[b00]'
+got=$(KSH_PARSECACHE=$tmp/pcache "$SHELL" -c "$script" 2>&1)
+[[ $got == "$exp"$'\n0 2' ]] || err_exit "parse cache: first run" \
+	"(expected $(printf %q "$exp"$'\n0 2'), got $(printf %q "$got"))"
+set -- "$tmp"/pcache/*.ksc
+(($# == 2)) || err_exit "parse cache: expected 2 cache files, got $#"
+got=$(KSH_PARSECACHE=$tmp/pcache "$SHELL" -c "$script" 2>&1)
+[[ $got == "$exp"$'\n2 0' ]] || err_exit "parse cache: second run" \
+	"(expected $(printf %q "$exp"$'\n2 0'), got $(printf %q "$got"))"
+# a changed file or a changed alias table must not use the cached tree
+print 'pcdot three' >>pcdot.sh
+got=$(KSH_PARSECACHE=$tmp/pcache "$SHELL" -c "alias pcx=true; $script" 2>&1)
+[[ $got == $'dot one two\ndot three\n[f00]\n[b00]\n0 2' ]] || err_exit "parse cache: stale cache used" \
+	"(got $(printf %q "$got"))"
+# a script with a syntax error is not cached
+print 'if true; then' >pcbad.sh
+got=$(KSH_PARSECACHE=$tmp/pcache "$SHELL" -c '. ./pcbad.sh' 2>&1)
+set -- "$tmp"/pcache/*
+(($# == 4)) || err_exit "parse cache: syntax error left a cache file (got $# files)"
+# not used without an absolute directory path
+got=$(KSH_PARSECACHE=pcache "$SHELL" -c "$script" 2>&1)
+[[ $got == $'dot one two\ndot three\n[f00]\n[b00]\n0 0' ]] || err_exit "parse cache: relative KSH_PARSECACHE used" \
+	"(got $(printf %q "$got"))"
+cd - >/dev/null
+
 # ======
 exit $((Errors<125?Errors:125))